@@ -0,0 +1,161 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "disruptor/arena_entry_factory.h"
+#include "disruptor/disruptor.h"
+
+namespace {
+
+std::atomic<int64_t> g_allocations{0};
+
+} // namespace
+
+// Counts every global heap allocation made by the process. Kept out of line so
+// GCC does not pair the inlined malloc/free with new/delete expressions.
+__attribute__((noinline)) void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+using disruptor::ArenaEntryFactory;
+using disruptor::BatchHandler;
+using disruptor::Disruptor;
+
+const char* const kSymbol = "EXCHANGE:INSTRUMENT-WITH-A-LONG-SYMBOL-NAME";
+constexpr int kFillsPerOrder = 16;
+
+struct HeapOrder {
+    std::string symbol;
+    std::vector<int64_t> fills;
+    int64_t id = 0;
+};
+
+// Resets heap-backed entries to a fresh state on reuse, which frees their
+// payloads only for the next publish to allocate them again.
+struct HeapOrderFactory {
+    void construct(HeapOrder* ptr) const { new (ptr) HeapOrder(); }
+    void destroy(HeapOrder* ptr) const { ptr->~HeapOrder(); }
+    void reset(HeapOrder& order) const { order = HeapOrder(); }
+};
+
+struct ArenaOrder {
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    explicit ArenaOrder(const allocator_type& allocator) noexcept
+        : symbol(allocator), fills(allocator) {}
+
+    std::pmr::string symbol;
+    std::pmr::vector<int64_t> fills;
+    int64_t id = 0;
+};
+
+template <typename Order>
+class OrderHandler : public BatchHandler<Order> {
+public:
+    void onAvailable(const Order& order, int64_t /*sequence*/, bool /*eob*/) override {
+        int64_t total = 0;
+        for (int64_t fill : order.fills) {
+            total += fill;
+        }
+        checksum_ += total + static_cast<int64_t>(order.symbol.size());
+        count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+
+private:
+    int64_t checksum_ = 0;
+    std::atomic<int64_t> count_{0};
+};
+
+template <typename Order, typename EntryFactory>
+int64_t countSteadyStateAllocations(Disruptor<Order, EntryFactory>& disruptor) {
+    const int64_t warmup = static_cast<int64_t>(disruptor.getRingBuffer()->getBufferSize()) * 2;
+    const int64_t events = 100'000;
+
+    OrderHandler<Order> handler;
+    disruptor.createConsumer(&handler);
+    auto* producer = disruptor.getProducerBarrier();
+    disruptor.start();
+
+    auto publish = [producer](int64_t i) {
+        int64_t seq = producer->nextEntry();
+        Order& order = producer->getEntry(seq);
+        order.id = i;
+        order.symbol.assign(kSymbol);
+        order.fills.clear();
+        for (int f = 0; f < kFillsPerOrder; f++) {
+            order.fills.push_back(i + f);
+        }
+        producer->commit(seq);
+    };
+
+    for (int64_t i = 0; i < warmup; i++) {
+        publish(i);
+    }
+    while (handler.getCount() < warmup) {
+        std::this_thread::yield();
+    }
+
+    int64_t before = g_allocations.load();
+    for (int64_t i = warmup; i < warmup + events; i++) {
+        publish(i);
+    }
+    while (handler.getCount() < warmup + events) {
+        std::this_thread::yield();
+    }
+    int64_t allocations = g_allocations.load() - before;
+
+    disruptor.stop();
+    return allocations;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "\n=== Per-Slot Arena Entries ===\n\n";
+
+    const size_t buffer_size = 1024;
+    const size_t arena_bytes = 512;
+
+    Disruptor<HeapOrder, HeapOrderFactory> heap_disruptor(buffer_size);
+    int64_t heap_allocations = countSteadyStateAllocations(heap_disruptor);
+    std::cout << "Reset-on-reuse entries, std::string/std::vector: "
+              << heap_allocations << " heap allocations in steady state\n";
+
+    using ArenaDisruptor = Disruptor<ArenaOrder, ArenaEntryFactory<ArenaOrder>>;
+    ArenaDisruptor arena_disruptor(buffer_size,
+                                   ArenaDisruptor::ClaimStrategyType::SINGLE_THREADED,
+                                   ArenaDisruptor::WaitStrategyType::YIELDING,
+                                   ArenaEntryFactory<ArenaOrder>(arena_bytes));
+    int64_t arena_allocations = countSteadyStateAllocations(arena_disruptor);
+    std::cout << "ArenaEntryFactory, std::pmr::string/std::pmr::vector: "
+              << arena_allocations << " heap allocations in steady state\n";
+
+    if (arena_allocations != 0) {
+        std::cout << "FAILED: arena-backed entries allocated from the global heap\n";
+        return 1;
+    }
+    return 0;
+}
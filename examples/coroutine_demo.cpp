@@ -0,0 +1,180 @@
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "disruptor/coroutine_consumer.h"
+#include "disruptor/disruptor.h"
+
+namespace {
+
+using disruptor::AsyncConsumerBarrier;
+using disruptor::ConsumerTask;
+using disruptor::CoroutineScheduler;
+using disruptor::Disruptor;
+using disruptor::Sequence;
+
+struct Event {
+    int64_t account;
+    int64_t amount;
+};
+
+// Stand-in for an asynchronous cache: lookups complete on another thread,
+// which hands the waiting coroutine back to the scheduler.
+class AsyncCache {
+public:
+    explicit AsyncCache(CoroutineScheduler* scheduler) : scheduler_(scheduler) {}
+
+    ~AsyncCache() {
+        stop();
+    }
+
+    void start() {
+        running_ = true;
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    struct LookupAwaiter {
+        AsyncCache* cache;
+        int64_t key;
+        int64_t value = 0;
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> caller) {
+            handle = caller;
+            std::lock_guard<std::mutex> lock(cache->mutex_);
+            cache->pending_.push_back(this);
+        }
+        int64_t await_resume() const noexcept { return value; }
+    };
+
+    LookupAwaiter lookup(int64_t key) { return LookupAwaiter{this, key}; }
+
+private:
+    void run() {
+        while (running_) {
+            std::deque<LookupAwaiter*> batch;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                batch.swap(pending_);
+            }
+            for (auto* request : batch) {
+                request->value = request->key * 7;
+                scheduler_->post(request->handle);
+            }
+            if (batch.empty()) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    CoroutineScheduler* scheduler_;
+    std::atomic<bool> running_{false};
+    std::mutex mutex_;
+    std::deque<LookupAwaiter*> pending_;
+    std::thread thread_;
+};
+
+ConsumerTask consume(int64_t id,
+                     int64_t consumer_count,
+                     AsyncConsumerBarrier<Event>& barrier,
+                     Sequence& sequence,
+                     AsyncCache& cache,
+                     std::atomic<int64_t>& handled,
+                     std::atomic<int64_t>& checksum) {
+    int64_t next_sequence = sequence.get() + 1;
+
+    while (true) {
+        int64_t available = co_await barrier.next(next_sequence);
+
+        for (; next_sequence <= available; next_sequence++) {
+            const Event& event = barrier.getEntry(next_sequence);
+            if (event.account % consumer_count != id) {
+                continue;
+            }
+
+            int64_t factor = co_await cache.lookup(event.account);
+            checksum.fetch_add(event.amount * factor, std::memory_order_relaxed);
+            handled.fetch_add(1, std::memory_order_release);
+        }
+
+        sequence.set(available);
+    }
+}
+
+} // namespace
+
+int main() {
+    std::cout << "\n=== Coroutine Consumers Demo ===\n\n";
+
+    const size_t buffer_size = 1024;
+    const int64_t consumer_count = 200;
+    const size_t scheduler_threads = 2;
+    const int64_t events = 20'000;
+
+    Disruptor<Event> disruptor(buffer_size);
+    disruptor::YieldingWaitStrategy wait_strategy;
+    CoroutineScheduler scheduler(&wait_strategy, scheduler_threads);
+    AsyncCache cache(&scheduler);
+
+    // Every consumer waits on the same barrier, so the scheduler reads the
+    // cursor once per poll however many coroutines are parked on it.
+    AsyncConsumerBarrier<Event> barrier(disruptor.createConsumerBarrier(), &scheduler);
+    std::vector<Sequence> sequences(consumer_count);
+    for (int64_t i = 0; i < consumer_count; i++) {
+        disruptor.addGatingSequence(&sequences[i]);
+    }
+
+    std::atomic<int64_t> handled{0};
+    std::atomic<int64_t> checksum{0};
+    for (int64_t i = 0; i < consumer_count; i++) {
+        scheduler.spawn(consume(i, consumer_count, barrier, sequences[i], cache, handled, checksum));
+    }
+
+    cache.start();
+    scheduler.start();
+
+    auto* producer = disruptor.getProducerBarrier();
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    int64_t expected_checksum = 0;
+    for (int64_t i = 0; i < events; i++) {
+        int64_t seq = producer->nextEntry();
+        Event& event = producer->getEntry(seq);
+        event.account = i;
+        event.amount = 1;
+        expected_checksum += i * 7;
+        producer->commit(seq);
+    }
+
+    while (handled.load(std::memory_order_acquire) < events) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration<double>(end_time - start_time).count();
+
+    // No coroutine may be resumed from outside once the scheduler stops.
+    cache.stop();
+    scheduler.stop();
+
+    std::cout << consumer_count << " coroutine consumers on " << scheduler_threads
+              << " threads handled " << handled.load() << " events in " << duration
+              << " seconds\n";
+    std::cout << "Checksum: " << checksum.load() << " (expected " << expected_checksum << ")\n";
+
+    return 0;
+}
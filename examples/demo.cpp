@@ -4,12 +4,20 @@
 #include <iostream>
 #include <thread>
 
+#include "disruptor/columnar_consumer.h"
+#include "disruptor/columnar_producer_barrier.h"
+#include "disruptor/columnar_ring_buffer.h"
 #include "disruptor/disruptor.h"
 
 namespace {
 
 using disruptor::BatchHandler;
+using disruptor::ColumnarBatchHandler;
+using disruptor::ColumnarConsumer;
+using disruptor::ColumnarProducerBarrier;
+using disruptor::ColumnarRingBuffer;
 using disruptor::Disruptor;
+using disruptor::EventPoller;
 
 struct Event {
     int64_t value;
@@ -149,6 +157,158 @@ void runPipelineDemo() {
     std::cout << "Each event went through 3 stages with dependencies\n";
 }
 
+// Stage of the layout comparison over the row layout: reads one field of the
+// entry and writes another, like ColumnarStageHandler below.
+template <int64_t PipelineEvent::*In, int64_t PipelineEvent::*Out, int64_t Mul, int64_t Add>
+class RowStageHandler : public BatchHandler<PipelineEvent> {
+public:
+    void onAvailable(const PipelineEvent& event, int64_t /*sequence*/, bool /*eob*/) override {
+        const_cast<PipelineEvent&>(event).*Out = event.*In * Mul + Add;
+        count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<int64_t> count_{0};
+};
+
+// Same pipeline as PipelineEvent, stored column-wise so each stage only
+// streams the two columns it touches.
+enum PipelineField { DATA, STAGE1, STAGE2, STAGE3 };
+using PipelineColumns = ColumnarRingBuffer<int64_t, int64_t, int64_t, int64_t>;
+
+template <PipelineField In, PipelineField Out, int64_t Mul, int64_t Add>
+class ColumnarStageHandler : public ColumnarBatchHandler<int64_t, int64_t, int64_t, int64_t> {
+public:
+    void onAvailable(PipelineColumns& ring, int64_t lo, int64_t hi) override {
+        ring.forEachSpan<In, Out>(lo, hi, [](const int64_t* in, int64_t* out, size_t count, int64_t) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = in[i] * Mul + Add;
+            }
+        });
+        count_.store(count_.load(std::memory_order_relaxed) + (hi - lo + 1),
+                     std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<int64_t> count_{0};
+};
+
+// Returns the elapsed seconds; last_stage3 receives the final entry's result.
+double timeRowPipeline(size_t buffer_size, int64_t events, int batch, int64_t& last_stage3) {
+    Disruptor<PipelineEvent> disruptor(buffer_size);
+
+    RowStageHandler<&PipelineEvent::data, &PipelineEvent::stage1_result, 2, 0> handler1;
+    RowStageHandler<&PipelineEvent::stage1_result, &PipelineEvent::stage2_result, 1, 10> handler2;
+    RowStageHandler<&PipelineEvent::stage2_result, &PipelineEvent::stage3_result, 3, 0> handler3;
+
+    auto* consumer1 = disruptor.createConsumer(&handler1);
+    auto* consumer2 = disruptor.createConsumer(&handler2, {consumer1->getSequence()});
+    disruptor.createConsumer(&handler3, {consumer2->getSequence()});
+    auto* producer = disruptor.getProducerBarrier();
+
+    disruptor.start();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    for (int64_t i = 0; i < events; i += batch) {
+        int64_t hi = producer->nextEntry(batch);
+        int64_t lo = hi - batch + 1;
+        for (int64_t seq = lo; seq <= hi; seq++) {
+            producer->getEntry(seq).data = seq;
+        }
+        producer->commit(lo, hi);
+    }
+
+    while (handler3.getCount() < events) {
+        std::this_thread::yield();
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    disruptor.stop();
+
+    last_stage3 = disruptor.getRingBuffer()->get(events - 1).stage3_result;
+    return std::chrono::duration<double>(end_time - start_time).count();
+}
+
+double timeColumnarPipeline(size_t buffer_size, int64_t events, int batch, int64_t& last_stage3) {
+    PipelineColumns ring(buffer_size);
+    disruptor::SingleThreadedClaimStrategy claim_strategy(ring.getBufferSize());
+    disruptor::YieldingWaitStrategy wait_strategy;
+
+    ColumnarStageHandler<DATA, STAGE1, 2, 0> handler1;
+    ColumnarStageHandler<STAGE1, STAGE2, 1, 10> handler2;
+    ColumnarStageHandler<STAGE2, STAGE3, 3, 0> handler3;
+
+    ColumnarConsumer<int64_t, int64_t, int64_t, int64_t> consumer1(&ring, &wait_strategy, &handler1);
+    ColumnarConsumer<int64_t, int64_t, int64_t, int64_t> consumer2(
+        &ring, &wait_strategy, &handler2, {consumer1.getSequence()});
+    ColumnarConsumer<int64_t, int64_t, int64_t, int64_t> consumer3(
+        &ring, &wait_strategy, &handler3, {consumer2.getSequence()});
+
+    ColumnarProducerBarrier<int64_t, int64_t, int64_t, int64_t> producer(
+        &ring, &claim_strategy, {consumer3.getSequence()});
+
+    consumer1.start();
+    consumer2.start();
+    consumer3.start();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    for (int64_t i = 0; i < events; i += batch) {
+        int64_t hi = producer.nextEntry(batch);
+        int64_t lo = hi - batch + 1;
+        for (int64_t seq = lo; seq <= hi; seq++) {
+            producer.getField<DATA>(seq) = seq;
+        }
+        producer.commit(lo, hi);
+    }
+
+    while (handler3.getCount() < events) {
+        std::this_thread::yield();
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    consumer1.stop();
+    consumer2.stop();
+    consumer3.stop();
+
+    last_stage3 = ring.get<STAGE3>(events - 1);
+    return std::chrono::duration<double>(end_time - start_time).count();
+}
+
+void runColumnarPipelineDemo() {
+    std::cout << "\n=== Row vs Columnar Three-Stage Pipeline ===\n\n";
+
+    const size_t buffer_size = 1024;
+    const int64_t events = 1'024'000;
+    const int batch = 64;
+    const int64_t expected = ((events - 1) * 2 + 10) * 3;
+
+    // A row stage pulls in every field of each entry it touches; a columnar
+    // stage streams only its input and output columns.
+    std::cout << "Bytes streamed per event per stage: row=" << sizeof(PipelineEvent)
+              << ", columnar=" << 2 * sizeof(int64_t) << "\n";
+
+    int64_t row_last = 0;
+    int64_t columnar_last = 0;
+    double row_seconds = timeRowPipeline(buffer_size, events, batch, row_last);
+    double columnar_seconds = timeColumnarPipeline(buffer_size, events, batch, columnar_last);
+
+    std::cout << "Row layout:      " << events << " events in " << row_seconds << " seconds ("
+              << (row_seconds / events * 1e9) << " ns/event), stage3=" << row_last << "\n";
+    std::cout << "Columnar layout: " << events << " events in " << columnar_seconds << " seconds ("
+              << (columnar_seconds / events * 1e9) << " ns/event), stage3=" << columnar_last
+              << "\n";
+    std::cout << "Speedup: " << (row_seconds / columnar_seconds) << "x (expected stage3="
+              << expected << ")\n";
+}
+
 void runSimpleRingBufferDemo() {
     std::cout << "\n=== Ring Buffer Demo ===\n\n";
 
@@ -176,6 +336,60 @@ void runSimpleRingBufferDemo() {
     }
 }
 
+void runEventPollerDemo() {
+    std::cout << "\n=== Event Poller Demo (three rings, one thread) ===\n\n";
+
+    const size_t buffer_size = 64;
+    const int64_t events_per_ring = 1000;
+    const int64_t max_events_per_poll = 16;
+
+    Disruptor<Event> disruptors[3] = {Disruptor<Event>(buffer_size),
+                                      Disruptor<Event>(buffer_size),
+                                      Disruptor<Event>(buffer_size)};
+    SimpleHandler handlers[3];
+    EventPoller<Event>* pollers[3];
+
+    for (int i = 0; i < 3; i++) {
+        pollers[i] = disruptors[i].createEventPoller();
+    }
+
+    std::thread producer([&disruptors]() {
+        for (int64_t i = 0; i < events_per_ring; i++) {
+            for (auto& d : disruptors) {
+                auto* barrier = d.getProducerBarrier();
+                int64_t seq = barrier->nextEntry();
+                Event& event = barrier->getEntry(seq);
+                event.value = i;
+                barrier->commit(seq);
+            }
+        }
+    });
+
+    int64_t idle_loops = 0;
+    while (handlers[0].getCount() < events_per_ring ||
+           handlers[1].getCount() < events_per_ring ||
+           handlers[2].getCount() < events_per_ring) {
+        bool progressed = false;
+        for (int i = 0; i < 3; i++) {
+            progressed |= pollers[i]->poll(&handlers[i], max_events_per_poll);
+        }
+
+        // An event loop would service its sockets here.
+        if (!progressed) {
+            idle_loops++;
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    for (int i = 0; i < 3; i++) {
+        std::cout << "Ring " << i << ": polled " << handlers[i].getCount()
+                  << " events, last value " << handlers[i].getLastValue() << "\n";
+    }
+    std::cout << "Idle loop iterations: " << idle_loops << "\n";
+}
+
 } // namespace
 
 int main() {
@@ -191,14 +405,18 @@ int main() {
     std::cout << "  - WaitStrategy (busy spin / yielding)\n";
     std::cout << "  - ProducerBarrier / ConsumerBarrier\n";
     std::cout << "  - BatchHandler / Consumer\n";
+    std::cout << "  - EventPoller (pull-based consumer)\n";
+    std::cout << "  - ColumnarRingBuffer (struct-of-arrays layout)\n";
 
     runSimpleRingBufferDemo();
+    runEventPollerDemo();
 
     std::cout << "\nNote: Full benchmark and pipeline demos are enabled.\n";
     std::cout << "They use a single producer, which is the supported mode here.\n";
 
     runBenchmark();
     runPipelineDemo();
+    runColumnarPipelineDemo();
 
     return 0;
 }
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "disruptor/disruptor.h"
+
+namespace {
+
+using disruptor::BatchHandler;
+using disruptor::Disruptor;
+using disruptor::Sequence;
+
+using Clock = std::chrono::steady_clock;
+
+struct PipelineEvent {
+    int64_t data;
+    int64_t stage1_result;
+    int64_t stage2_result;
+    int64_t stage3_result;
+    int64_t publish_time;
+};
+
+int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+        .count();
+}
+
+// Stand-in for a few hundred nanoseconds of per-event work.
+int64_t work(int64_t value) {
+    for (int i = 0; i < 200; i++) {
+        value = value * 6364136223846793005LL + 1442695040888963407LL;
+    }
+    return value;
+}
+
+class StageHandler : public BatchHandler<PipelineEvent> {
+public:
+    StageHandler(int stage, bool report_each_event) : stage_(stage), report_each_event_(report_each_event) {}
+
+    void setSequenceCallback(Sequence* sequence) override { sequence_ = sequence; }
+
+    void onAvailable(const PipelineEvent& event, int64_t sequence, bool /*eob*/) override {
+        auto& mutable_event = const_cast<PipelineEvent&>(event);
+        if (stage_ == 1) {
+            mutable_event.stage1_result = work(event.data);
+        } else {
+            mutable_event.stage2_result = work(event.stage1_result);
+        }
+        if (report_each_event_) {
+            sequence_->set(sequence);
+        }
+    }
+
+private:
+    const int stage_;
+    const bool report_each_event_;
+    Sequence* sequence_ = nullptr;
+};
+
+class LatencyHandler : public BatchHandler<PipelineEvent> {
+public:
+    explicit LatencyHandler(int64_t events) : latencies_(events) {}
+
+    void onAvailable(const PipelineEvent& event, int64_t sequence, bool /*eob*/) override {
+        const_cast<PipelineEvent&>(event).stage3_result = work(event.stage2_result);
+        latencies_[sequence] = now() - event.publish_time;
+        count_.store(sequence + 1, std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+    std::vector<int64_t>& getLatencies() { return latencies_; }
+
+private:
+    std::vector<int64_t> latencies_;
+    std::atomic<int64_t> count_{0};
+};
+
+struct Config {
+    const char* name;
+    int64_t max_batch_size;
+    int64_t progress_interval;
+    bool report_each_event;
+};
+
+void runConfig(const Config& config) {
+    const size_t buffer_size = 4096;
+    const int64_t burst = 1000;
+    const int64_t bursts = 50;
+    const int64_t events = burst * bursts;
+
+    Disruptor<PipelineEvent> disruptor(buffer_size);
+
+    StageHandler handler1(1, config.report_each_event);
+    StageHandler handler2(2, config.report_each_event);
+    LatencyHandler handler3(events);
+
+    auto* consumer1 = disruptor.createConsumer(&handler1);
+    auto* consumer2 = disruptor.createConsumer(&handler2, {consumer1->getSequence()});
+    auto* consumer3 = disruptor.createConsumer(&handler3, {consumer2->getSequence()});
+
+    for (auto* consumer : {consumer1, consumer2, consumer3}) {
+        if (config.max_batch_size > 0) {
+            consumer->setMaxBatchSize(config.max_batch_size);
+        }
+        consumer->setProgressInterval(config.progress_interval);
+    }
+
+    auto* producer = disruptor.getProducerBarrier();
+    disruptor.start();
+
+    for (int64_t b = 0; b < bursts; b++) {
+        int64_t hi = producer->nextEntry(static_cast<int>(burst));
+        int64_t lo = hi - burst + 1;
+        int64_t publish_time = now();
+        for (int64_t seq = lo; seq <= hi; seq++) {
+            PipelineEvent& event = producer->getEntry(seq);
+            event.data = seq;
+            event.publish_time = publish_time;
+        }
+        producer->commit(lo, hi);
+
+        while (handler3.getCount() < hi + 1) {
+            std::this_thread::yield();
+        }
+    }
+
+    disruptor.stop();
+
+    auto& latencies = handler3.getLatencies();
+    std::sort(latencies.begin(), latencies.end());
+    double mean = 0;
+    for (int64_t latency : latencies) {
+        mean += static_cast<double>(latency);
+    }
+    mean /= static_cast<double>(events);
+
+    std::cout << "  " << config.name << "\n"
+              << "    mean " << (mean / 1e3) << " us"
+              << ", p50 " << (latencies[events / 2] / 1e3) << " us"
+              << ", p99 " << (latencies[events * 99 / 100] / 1e3) << " us\n";
+}
+
+} // namespace
+
+int main() {
+    std::cout << "\n=== Three-Stage Pipeline Latency (1000-event bursts) ===\n\n";
+
+    const Config configs[] = {
+        {"whole batch (default)", 0, 0, false},
+        {"max batch size 64", 64, 0, false},
+        {"progress every 16 events", 0, 16, false},
+        {"handler reports every event via setSequenceCallback", 0, 0, true},
+    };
+
+    for (const auto& config : configs) {
+        runConfig(config);
+    }
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "disruptor/sharded_disruptor.h"
+
+namespace {
+
+using disruptor::BatchHandler;
+using disruptor::ShardedDisruptor;
+
+struct AccountEvent {
+    int64_t account;
+    int64_t amount;
+    int64_t account_sequence;
+    // Events fully published before this one was claimed; the merge must
+    // place at least that many events ahead of it.
+    int64_t published_before;
+};
+
+constexpr int64_t kAccountsPerShard = 1024;
+
+// Flags any event whose account_sequence does not increase for its account.
+class AccountOrderCheck {
+public:
+    explicit AccountOrderCheck(size_t account_count) : last_seen_(account_count, -1) {}
+
+    void observe(const AccountEvent& event) {
+        int64_t& last_seen = last_seen_[static_cast<size_t>(event.account)];
+        if (event.account_sequence <= last_seen) {
+            out_of_order_++;
+        }
+        last_seen = event.account_sequence;
+    }
+
+    int64_t getOutOfOrder() const { return out_of_order_; }
+
+private:
+    std::vector<int64_t> last_seen_;
+    int64_t out_of_order_ = 0;
+};
+
+class AccountHandler : public BatchHandler<AccountEvent> {
+public:
+    explicit AccountHandler(size_t account_count)
+        : balances_(account_count), order_check_(account_count) {}
+
+    void onAvailable(const AccountEvent& event, int64_t /*sequence*/, bool /*eob*/) override {
+        order_check_.observe(event);
+
+        // Stand-in for per-account business logic.
+        int64_t& balance = balances_[static_cast<size_t>(event.account)];
+        for (int i = 0; i < 64; i++) {
+            balance = balance * 31 + event.amount;
+        }
+
+        count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+    int64_t getOutOfOrder() const { return order_check_.getOutOfOrder(); }
+
+private:
+    std::vector<int64_t> balances_;
+    AccountOrderCheck order_check_;
+    std::atomic<int64_t> count_{0};
+};
+
+// Checks the merged stream across shards: per-account order still holds, and
+// no event comes out ahead of an event whose publish finished before it began.
+class MergeHandler : public BatchHandler<AccountEvent> {
+public:
+    explicit MergeHandler(size_t account_count) : order_check_(account_count) {}
+
+    void onAvailable(const AccountEvent& event, int64_t sequence, bool /*eob*/) override {
+        order_check_.observe(event);
+        if (event.published_before > sequence) {
+            out_of_global_order_++;
+        }
+        count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    int64_t getCount() const { return count_.load(std::memory_order_acquire); }
+    int64_t getOutOfOrder() const { return order_check_.getOutOfOrder() + out_of_global_order_; }
+
+private:
+    AccountOrderCheck order_check_;
+    int64_t out_of_global_order_ = 0;
+    std::atomic<int64_t> count_{0};
+};
+
+double runShards(size_t shard_count, int64_t events_per_shard, bool merge) {
+    ShardedDisruptor<AccountEvent> sharded(shard_count, 4096);
+
+    // Give each producer the accounts that hash onto its shard, so no two
+    // threads publish into the same single-threaded shard.
+    std::vector<std::vector<int64_t>> accounts(shard_count);
+    int64_t account_count = 0;
+    for (size_t filled = 0; filled < shard_count; account_count++) {
+        auto& owned = accounts[sharded.shardFor(account_count)];
+        if (static_cast<int64_t>(owned.size()) < kAccountsPerShard) {
+            owned.push_back(account_count);
+            if (static_cast<int64_t>(owned.size()) == kAccountsPerShard) {
+                filled++;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<AccountHandler>> handlers;
+    std::vector<BatchHandler<AccountEvent>*> stage;
+    for (size_t i = 0; i < shard_count; i++) {
+        handlers.push_back(std::make_unique<AccountHandler>(static_cast<size_t>(account_count)));
+        stage.push_back(handlers.back().get());
+    }
+    sharded.handleEventsWith(stage);
+
+    MergeHandler merge_handler(static_cast<size_t>(account_count));
+    if (merge) {
+        sharded.mergeWith(&merge_handler);
+    }
+
+    sharded.start();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    std::atomic<int64_t> published{0};
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < shard_count; p++) {
+        producers.emplace_back([&, &owned = accounts[p]]() {
+            std::vector<int64_t> account_sequences(kAccountsPerShard, 0);
+            for (int64_t i = 0; i < events_per_shard; i++) {
+                size_t slot = static_cast<size_t>(i % kAccountsPerShard);
+                int64_t account = owned[slot];
+                sharded.publish(account, [&](AccountEvent& event) {
+                    event.account = account;
+                    event.amount = i;
+                    event.account_sequence = account_sequences[slot]++;
+                    event.published_before = merge ? published.load(std::memory_order_acquire) : 0;
+                });
+                if (merge) {
+                    published.fetch_add(1, std::memory_order_release);
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    const int64_t total = events_per_shard * static_cast<int64_t>(shard_count);
+    for (auto& handler : handlers) {
+        while (handler->getCount() < events_per_shard) {
+            std::this_thread::yield();
+        }
+    }
+    while (merge && merge_handler.getCount() < total) {
+        std::this_thread::yield();
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(end_time - start_time).count();
+
+    sharded.stop();
+
+    int64_t out_of_order = merge_handler.getOutOfOrder();
+    for (auto& handler : handlers) {
+        out_of_order += handler->getOutOfOrder();
+    }
+    if (out_of_order != 0) {
+        std::cout << "  ordering violations: " << out_of_order << "\n";
+    }
+
+    return total / duration;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "\n=== Sharded Disruptor Scaling Benchmark ===\n\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    const int64_t events_per_shard = 1'000'000;
+    const size_t shard_counts[] = {1, 2, 4};
+
+    for (bool merge : {false, true}) {
+        std::cout << (merge ? "With merge stage:\n" : "Without merge stage:\n");
+        double baseline = 0;
+        for (size_t shards : shard_counts) {
+            double throughput = runShards(shards, events_per_shard, merge);
+            if (baseline == 0) {
+                baseline = throughput;
+            }
+            std::cout << "  shards=" << shards
+                      << "  throughput=" << (throughput / 1e6) << " M events/sec"
+                      << "  scaling=" << (throughput / baseline) << "x\n";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace disruptor {
+
+// EntryFactory that gives every ring slot its own preallocated bump arena.
+// Entries are constructed with a pmr allocator over their slot's arena, so
+// std::pmr::string / std::pmr::vector payloads grow without touching the
+// global heap. prepareForWrite() destroys the old entry, rewinds the arena and
+// constructs a fresh entry in place; sized so payloads fit in arena_bytes, the
+// publish -> consume cycle performs no heap allocation. Payloads that outgrow
+// the arena spill to the upstream resource until the slot is next reset.
+// Because the old entry is already gone when its replacement is constructed,
+// T's allocator constructor must be noexcept.
+template <typename T>
+class ArenaEntryFactory {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    static_assert(std::is_nothrow_constructible_v<T, const allocator_type&>,
+                  "ArenaEntryFactory entries must be nothrow constructible from a "
+                  "polymorphic_allocator");
+
+    explicit ArenaEntryFactory(size_t arena_bytes,
+                               std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : arena_bytes_(arena_bytes), upstream_(upstream) {
+        if (arena_bytes_ == 0) {
+            throw std::invalid_argument("ArenaEntryFactory requires a non-empty arena.");
+        }
+    }
+
+    void construct(T* ptr, size_t slot) {
+        if (slot >= arenas_.size()) {
+            arenas_.resize(slot + 1);
+        }
+        arenas_[slot] = std::make_unique<SlotArena>(arena_bytes_, upstream_);
+        new (ptr) T(allocator_type(&arenas_[slot]->resource));
+    }
+
+    void destroy(T* ptr, size_t slot) {
+        ptr->~T();
+        arenas_[slot].reset();
+    }
+
+    void reset(T& entry, size_t slot) {
+        SlotArena& arena = *arenas_[slot];
+        entry.~T();
+        arena.resource.release();
+        new (&entry) T(allocator_type(&arena.resource));
+    }
+
+private:
+    struct SlotArena {
+        SlotArena(size_t bytes, std::pmr::memory_resource* upstream)
+            : buffer(new std::byte[bytes]), resource(buffer.get(), bytes, upstream) {}
+
+        std::unique_ptr<std::byte[]> buffer;
+        std::pmr::monotonic_buffer_resource resource;
+    };
+
+    size_t arena_bytes_;
+    std::pmr::memory_resource* upstream_;
+    std::vector<std::unique_ptr<SlotArena>> arenas_;
+};
+
+} // namespace disruptor
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "disruptor/sequence.h"
+
 namespace disruptor {
 
 template <typename T>
@@ -12,6 +14,12 @@ public:
     virtual void onAvailable(const T& entry, int64_t sequence, bool end_of_batch) = 0;
 
     virtual void onCompletion() {}
+
+    // Called with the consumer's sequence before a Consumer starts, and with
+    // the poller's sequence before each batch EventPoller::poll() delivers; a
+    // handler may set() it to an already processed sequence to release
+    // downstream stages early.
+    virtual void setSequenceCallback(Sequence* /*sequence*/) {}
 };
 
 } // namespace disruptor
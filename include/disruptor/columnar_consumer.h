@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "disruptor/columnar_ring_buffer.h"
+#include "disruptor/sequence.h"
+#include "disruptor/wait_strategy.h"
+
+namespace disruptor {
+
+// Receives the whole available range at once so a stage can run a tight
+// (vectorisable) loop over just the columns it needs via forEachSpan().
+template <typename... Fields>
+class ColumnarBatchHandler {
+public:
+    virtual ~ColumnarBatchHandler() = default;
+
+    virtual void onAvailable(ColumnarRingBuffer<Fields...>& ring_buffer,
+                             int64_t lo,
+                             int64_t hi) = 0;
+
+    virtual void onCompletion() {}
+};
+
+template <typename... Fields>
+class ColumnarConsumer {
+public:
+    ColumnarConsumer(ColumnarRingBuffer<Fields...>* ring_buffer,
+                     WaitStrategy* wait_strategy,
+                     ColumnarBatchHandler<Fields...>* handler,
+                     std::vector<Sequence*> dependents = {})
+        : ring_buffer_(ring_buffer)
+        , wait_strategy_(wait_strategy)
+        , handler_(handler)
+        , dependent_sequences_(std::move(dependents)) {}
+
+    ~ColumnarConsumer() {
+        stop();
+    }
+
+    void start() {
+        running_ = true;
+        alerted_ = false;
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        running_ = false;
+        alerted_ = true;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    Sequence* getSequence() { return &sequence_; }
+
+private:
+    void run() {
+        int64_t next_sequence = sequence_.get() + 1;
+
+        while (running_) {
+            try {
+                int64_t available = wait_strategy_->waitFor(next_sequence,
+                                                            ring_buffer_->getCursor(),
+                                                            dependent_sequences_,
+                                                            alerted_);
+
+                handler_->onAvailable(*ring_buffer_, next_sequence, available);
+                next_sequence = available + 1;
+
+                sequence_.set(available);
+            } catch (...) {
+                break;
+            }
+        }
+
+        handler_->onCompletion();
+    }
+
+    ColumnarRingBuffer<Fields...>* ring_buffer_;
+    WaitStrategy* wait_strategy_;
+    ColumnarBatchHandler<Fields...>* handler_;
+    std::vector<Sequence*> dependent_sequences_;
+    Sequence sequence_{-1};
+    std::atomic<bool> running_{false};
+    std::atomic<bool> alerted_{false};
+    std::thread thread_;
+};
+
+} // namespace disruptor
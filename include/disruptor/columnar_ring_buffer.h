@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "disruptor/sequence.h"
+
+namespace disruptor {
+
+// Struct-of-arrays ring buffer: each field in Fields... lives in its own
+// cache-line aligned array, so a stage that reads one field only pulls that
+// column through the cache. Fields are addressed by index.
+template <typename... Fields>
+class ColumnarRingBuffer {
+public:
+    static_assert(sizeof...(Fields) > 0, "ColumnarRingBuffer requires at least one field");
+
+    static constexpr size_t kColumnAlignment = 64;
+
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    explicit ColumnarRingBuffer(size_t size)
+        : buffer_size_(roundUpToPowerOfTwo(size))
+        , index_mask_(buffer_size_ - 1)
+        , columns_(Column<Fields>(buffer_size_)...) {}
+
+    ColumnarRingBuffer(const ColumnarRingBuffer&) = delete;
+    ColumnarRingBuffer& operator=(const ColumnarRingBuffer&) = delete;
+
+    size_t getBufferSize() const { return buffer_size_; }
+
+    template <size_t I>
+    FieldType<I>& get(int64_t sequence) {
+        return column<I>()[sequence & index_mask_];
+    }
+
+    template <size_t I>
+    const FieldType<I>& get(int64_t sequence) const {
+        return column<I>()[sequence & index_mask_];
+    }
+
+    template <size_t I>
+    FieldType<I>* column() {
+        return std::get<I>(columns_).data;
+    }
+
+    template <size_t I>
+    const FieldType<I>* column() const {
+        return std::get<I>(columns_).data;
+    }
+
+    // Calls fn(data, count, first_sequence) for each contiguous run of column I
+    // covering [lo, hi]; a range that wraps the ring yields two runs.
+    template <size_t I, typename Fn>
+    void forEachSpan(int64_t lo, int64_t hi, Fn&& fn) {
+        FieldType<I>* data = column<I>();
+        forEachRun(lo, hi, [&](size_t index, size_t count, int64_t first) {
+            fn(data + index, count, first);
+        });
+    }
+
+    template <size_t I, typename Fn>
+    void forEachSpan(int64_t lo, int64_t hi, Fn&& fn) const {
+        const FieldType<I>* data = column<I>();
+        forEachRun(lo, hi, [&](size_t index, size_t count, int64_t first) {
+            fn(data + index, count, first);
+        });
+    }
+
+    // Two-column form for kernels that read column In and write column Out:
+    // calls fn(in, out, count, first_sequence) with both runs aligned.
+    template <size_t In, size_t Out, typename Fn>
+    void forEachSpan(int64_t lo, int64_t hi, Fn&& fn) {
+        const FieldType<In>* in = column<In>();
+        FieldType<Out>* out = column<Out>();
+        forEachRun(lo, hi, [&](size_t index, size_t count, int64_t first) {
+            fn(in + index, out + index, count, first);
+        });
+    }
+
+    Sequence* getCursor() { return &cursor_; }
+    const Sequence* getCursor() const { return &cursor_; }
+
+    void publish(int64_t sequence) {
+        cursor_.setMonotonic(sequence);
+    }
+
+    void publish(int64_t /*lo*/, int64_t hi) {
+        cursor_.setMonotonic(hi);
+    }
+
+private:
+    template <typename U>
+    struct Column {
+        // Over-aligned fields need more than a cache line.
+        static constexpr std::align_val_t kAlignment{std::max(kColumnAlignment, alignof(U))};
+
+        explicit Column(size_t capacity)
+            : size(capacity)
+            , data(static_cast<U*>(::operator new(capacity * sizeof(U), kAlignment))) {
+            static_assert(std::is_nothrow_destructible_v<U>,
+                          "ColumnarRingBuffer fields must be nothrow destructible");
+            size_t constructed = 0;
+            try {
+                for (; constructed < capacity; ++constructed) {
+                    new (data + constructed) U();
+                }
+            } catch (...) {
+                for (size_t i = 0; i < constructed; ++i) {
+                    data[i].~U();
+                }
+                ::operator delete(data, kAlignment);
+                throw;
+            }
+        }
+
+        Column(Column&& other) noexcept : size(other.size), data(other.data) {
+            other.data = nullptr;
+        }
+
+        ~Column() {
+            if (!data) {
+                return;
+            }
+            for (size_t i = 0; i < size; ++i) {
+                data[i].~U();
+            }
+            ::operator delete(data, kAlignment);
+        }
+
+        Column(const Column&) = delete;
+        Column& operator=(const Column&) = delete;
+        Column& operator=(Column&&) = delete;
+
+        size_t size;
+        U* data;
+    };
+
+    template <typename Fn>
+    void forEachRun(int64_t lo, int64_t hi, Fn&& fn) const {
+        while (lo <= hi) {
+            size_t index = static_cast<size_t>(lo) & index_mask_;
+            size_t count = static_cast<size_t>(hi - lo + 1);
+            if (count > buffer_size_ - index) {
+                count = buffer_size_ - index;
+            }
+            fn(index, count, lo);
+            lo += static_cast<int64_t>(count);
+        }
+    }
+
+    static size_t roundUpToPowerOfTwo(size_t v) {
+        v--;
+        v |= v >> 1;
+        v |= v >> 2;
+        v |= v >> 4;
+        v |= v >> 8;
+        v |= v >> 16;
+        v |= v >> 32;
+        v++;
+        return v;
+    }
+
+    const size_t buffer_size_;
+    const size_t index_mask_;
+    std::tuple<Column<Fields>...> columns_;
+    Sequence cursor_{-1};
+};
+
+} // namespace disruptor
@@ -1,14 +1,37 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "disruptor/batch_handler.h"
 #include "disruptor/consumer_barrier.h"
 #include "disruptor/sequence.h"
 
 namespace disruptor {
 
+// Pins thread to a CPU on Linux; -1 leaves it unpinned.
+inline void pinThreadToCpu(std::thread& thread, int cpu) {
+#if defined(__linux__)
+    if (cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+    }
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
 template <typename T, typename EntryFactory = DefaultEntryFactory<T>>
 class Consumer {
 public:
@@ -21,16 +44,41 @@ public:
 
     void start() {
         running_ = true;
+        barrier_->clearAlert();
+        handler_->setSequenceCallback(&sequence_);
         thread_ = std::thread([this]() { run(); });
+        pinThreadToCpu(thread_, cpu_);
     }
 
     void stop() {
         running_ = false;
+        barrier_->alert();
         if (thread_.joinable()) {
             thread_.join();
         }
     }
 
+    // Pins the consumer thread to a CPU on the next start(); -1 leaves it unpinned.
+    void setCpuAffinity(int cpu) { cpu_ = cpu; }
+
+    // Caps how many entries are handled before the sequence is published.
+    // Must be called before start(); the consumer thread reads it unsynchronised.
+    void setMaxBatchSize(int64_t max_batch_size) {
+        if (max_batch_size <= 0) {
+            throw std::invalid_argument("max_batch_size must be positive.");
+        }
+        max_batch_size_ = max_batch_size;
+    }
+
+    // Publishes the sequence every progress_interval entries within a batch;
+    // 0 publishes only at the end of each batch. Must be called before start().
+    void setProgressInterval(int64_t progress_interval) {
+        if (progress_interval < 0) {
+            throw std::invalid_argument("progress_interval must not be negative.");
+        }
+        progress_interval_ = progress_interval;
+    }
+
     Sequence* getSequence() { return &sequence_; }
 
 private:
@@ -40,12 +88,21 @@ private:
         while (running_) {
             try {
                 int64_t available = barrier_->waitFor(next_sequence);
+                if (available - next_sequence >= max_batch_size_) {
+                    available = next_sequence + max_batch_size_ - 1;
+                }
 
+                int64_t since_progress = 0;
                 while (next_sequence <= available) {
                     T& entry = barrier_->getEntry(next_sequence);
                     bool end_of_batch = (next_sequence == available);
 
                     handler_->onAvailable(entry, next_sequence, end_of_batch);
+
+                    if (++since_progress == progress_interval_ && !end_of_batch) {
+                        sequence_.set(next_sequence);
+                        since_progress = 0;
+                    }
                     next_sequence++;
                 }
 
@@ -62,6 +119,9 @@ private:
     BatchHandler<T>* handler_;
     Sequence sequence_{-1};
     std::atomic<bool> running_{false};
+    int64_t max_batch_size_ = std::numeric_limits<int64_t>::max();
+    int64_t progress_interval_ = 0;
+    int cpu_ = -1;
     std::thread thread_;
 };
 
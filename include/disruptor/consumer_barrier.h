@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 
 #include "disruptor/ring_buffer.h"
 #include "disruptor/sequence.h"
+#include "disruptor/sequence_group.h"
 #include "disruptor/wait_strategy.h"
 
 namespace disruptor {
@@ -20,7 +22,15 @@ public:
         , dependent_sequences_(std::move(dependents)) {}
 
     int64_t waitFor(int64_t sequence) {
-        return wait_strategy_->waitFor(sequence, cursor_, dependent_sequences_);
+        return wait_strategy_->waitFor(sequence, cursor_, dependent_sequences_, alerted_);
+    }
+
+    void alert() { alerted_.store(true, std::memory_order_release); }
+    void clearAlert() { alerted_.store(false, std::memory_order_release); }
+    bool isAlerted() const { return alerted_.load(std::memory_order_acquire); }
+
+    int64_t getAvailableSequence() {
+        return getMinimumSequence(cursor_, dependent_sequences_);
     }
 
     const T& getEntry(int64_t sequence) const {
@@ -36,6 +46,7 @@ private:
     WaitStrategy* wait_strategy_;
     Sequence* cursor_;
     std::vector<Sequence*> dependent_sequences_;
+    std::atomic<bool> alerted_{false};
 };
 
 } // namespace disruptor
@@ -0,0 +1,374 @@
+#pragma once
+
+#if __cplusplus < 202002L
+#error "disruptor/coroutine_consumer.h requires C++20"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "disruptor/consumer_barrier.h"
+#include "disruptor/wait_strategy.h"
+
+namespace disruptor {
+
+class CoroutineScheduler;
+
+// Fire-and-forget coroutine run by a CoroutineScheduler. It starts suspended
+// and only runs once handed to CoroutineScheduler::spawn().
+class ConsumerTask {
+public:
+    struct promise_type {
+        ConsumerTask get_return_object() {
+            return ConsumerTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept { return FinalAwaiter{}; }
+        void return_void() {}
+        // An escaping exception ends the consumer; FinalAwaiter reports it to
+        // the scheduler, since the coroutine's gating sequence stops advancing.
+        void unhandled_exception() { exception = std::current_exception(); }
+
+        CoroutineScheduler* scheduler = nullptr;
+        std::exception_ptr exception;
+    };
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    ConsumerTask(ConsumerTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    ~ConsumerTask() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    ConsumerTask(const ConsumerTask&) = delete;
+    ConsumerTask& operator=(const ConsumerTask&) = delete;
+    ConsumerTask& operator=(ConsumerTask&&) = delete;
+
+    std::coroutine_handle<promise_type> release() { return std::exchange(handle_, nullptr); }
+
+private:
+    explicit ConsumerTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// A coroutine parked until a sequence becomes available. Lives in the
+// suspended coroutine's frame. Waiters sharing a source (e.g. the same
+// ConsumerBarrier) must report the same available sequence: the scheduler
+// reads it once per source on each poll.
+struct SequenceWaiter {
+    virtual ~SequenceWaiter() = default;
+    virtual int64_t getAvailableSequence() = 0;
+
+    const void* source = nullptr;
+    std::coroutine_handle<> handle;
+    int64_t sequence = 0;
+    int64_t available = -1;
+};
+
+// Runs many coroutine consumers on a few threads. Parked waiters are polled
+// whenever no coroutine is runnable and every kWaiterPollInterval resumes
+// otherwise, so a steady stream of ready work cannot starve them. One worker
+// polls at a time, reading each source's sequence once; idle workers back off
+// through the WaitStrategy's idle() hook.
+class CoroutineScheduler {
+public:
+    static constexpr int kWaiterPollInterval = 64;
+
+    CoroutineScheduler(WaitStrategy* wait_strategy, size_t thread_count)
+        : wait_strategy_(wait_strategy), thread_count_(thread_count) {
+        if (thread_count_ == 0) {
+            throw std::invalid_argument("CoroutineScheduler requires at least one thread.");
+        }
+    }
+
+    ~CoroutineScheduler() {
+        shutdown();
+    }
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    // Called on the worker thread when a coroutine ends with an exception.
+    // Must be set before start() and must not throw.
+    void setErrorHandler(std::function<void(std::exception_ptr)> handler) {
+        error_handler_ = std::move(handler);
+    }
+
+    void spawn(ConsumerTask task) {
+        auto handle = task.release();
+        handle.promise().scheduler = this;
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(handle);
+        ready_.push_back(handle);
+        ready_count_.store(ready_.size(), std::memory_order_release);
+    }
+
+    // Makes a suspended coroutine runnable again, e.g. from the completion
+    // callback of an asynchronous lookup. Safe to call from any thread; once
+    // stop() has begun the handle is dropped.
+    void post(std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        ready_.push_back(handle);
+        ready_count_.store(ready_.size(), std::memory_order_release);
+    }
+
+    void park(SequenceWaiter* waiter) {
+        std::lock_guard<std::mutex> lock(waiters_mutex_);
+        WaiterGroup* group = nullptr;
+        for (WaiterGroup& candidate : waiter_groups_) {
+            if (candidate.source == waiter->source) {
+                group = &candidate;
+                break;
+            }
+        }
+        if (!group) {
+            group = &waiter_groups_.emplace_back();
+            group->source = waiter->source;
+        }
+        group->waiters.push_back(waiter);
+        group->min_sequence = std::min(group->min_sequence, waiter->sequence);
+    }
+
+    // co_await scheduler.schedule() requeues the caller behind other work.
+    auto schedule() {
+        struct Awaiter {
+            CoroutineScheduler* scheduler;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { scheduler->post(handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this};
+    }
+
+    void start() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = false;
+        }
+        running_ = true;
+        for (size_t i = 0; i < thread_count_; ++i) {
+            threads_.emplace_back([this]() { run(); });
+        }
+    }
+
+    // Joins the workers and destroys every spawned coroutine frame, including
+    // those suspended on an external awaitable, then rethrows the first
+    // exception that ended a coroutine, if any. Whatever may still resume a
+    // coroutine or write into its frame, such as the completion thread of an
+    // asynchronous lookup, must be quiesced first; later post() calls are
+    // dropped.
+    void stop() {
+        shutdown();
+        std::exception_ptr failure = std::exchange(first_failure_, nullptr);
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+private:
+    friend class ConsumerTask;
+
+    void reportFailure(std::exception_ptr exception) noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!first_failure_) {
+                first_failure_ = exception;
+            }
+        }
+        if (error_handler_) {
+            error_handler_(exception);
+        }
+    }
+
+    struct WaiterGroup {
+        const void* source = nullptr;
+        int64_t min_sequence = std::numeric_limits<int64_t>::max();
+        std::vector<SequenceWaiter*> waiters;
+    };
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        running_ = false;
+        for (auto& thread : threads_) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads_.clear();
+
+        std::scoped_lock lock(waiters_mutex_, mutex_);
+        for (auto handle : tasks_) {
+            handle.destroy();
+        }
+        tasks_.clear();
+        ready_.clear();
+        ready_count_.store(0, std::memory_order_release);
+        waiter_groups_.clear();
+    }
+
+    void run() {
+        int spin_tries = 0;
+        int resumes_since_poll = 0;
+        while (running_) {
+            std::coroutine_handle<> handle = nextReady(resumes_since_poll);
+            if (handle) {
+                handle.resume();
+                spin_tries = 0;
+            } else {
+                wait_strategy_->idle(spin_tries);
+            }
+        }
+    }
+
+    std::coroutine_handle<> nextReady(int& resumes_since_poll) {
+        if (ready_count_.load(std::memory_order_acquire) == 0 ||
+            ++resumes_since_poll >= kWaiterPollInterval) {
+            resumes_since_poll = 0;
+            pollWaiters();
+            if (ready_count_.load(std::memory_order_acquire) == 0) {
+                return nullptr;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready_.empty()) {
+            return nullptr;
+        }
+        std::coroutine_handle<> handle = ready_.front();
+        ready_.pop_front();
+        ready_count_.store(ready_.size(), std::memory_order_release);
+        return handle;
+    }
+
+    // Moves every waiter whose sequence is available to the ready queue. A
+    // worker that finds another one polling skips the scan.
+    void pollWaiters() {
+        std::unique_lock<std::mutex> lock(waiters_mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return;
+        }
+        for (WaiterGroup& group : waiter_groups_) {
+            if (group.waiters.empty()) {
+                continue;
+            }
+            int64_t available = group.waiters.front()->getAvailableSequence();
+            if (available < group.min_sequence) {
+                continue;
+            }
+            int64_t min_sequence = std::numeric_limits<int64_t>::max();
+            for (size_t i = 0; i < group.waiters.size();) {
+                SequenceWaiter* waiter = group.waiters[i];
+                if (available >= waiter->sequence) {
+                    waiter->available = available;
+                    woken_.push_back(waiter->handle);
+                    group.waiters[i] = group.waiters.back();
+                    group.waiters.pop_back();
+                } else {
+                    min_sequence = std::min(min_sequence, waiter->sequence);
+                    ++i;
+                }
+            }
+            group.min_sequence = min_sequence;
+        }
+        if (woken_.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> ready_lock(mutex_);
+        ready_.insert(ready_.end(), woken_.begin(), woken_.end());
+        ready_count_.store(ready_.size(), std::memory_order_release);
+        woken_.clear();
+    }
+
+    WaitStrategy* wait_strategy_;
+    const size_t thread_count_;
+    std::atomic<bool> running_{false};
+    std::mutex mutex_;
+    std::vector<std::coroutine_handle<>> tasks_;
+    std::deque<std::coroutine_handle<>> ready_;
+    std::atomic<size_t> ready_count_{0};
+    bool stopping_ = false;
+    std::mutex waiters_mutex_;
+    std::vector<WaiterGroup> waiter_groups_;
+    std::vector<std::coroutine_handle<>> woken_;
+    std::vector<std::thread> threads_;
+    std::function<void(std::exception_ptr)> error_handler_;
+    std::exception_ptr first_failure_;
+};
+
+inline void ConsumerTask::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) noexcept {
+    promise_type& promise = handle.promise();
+    if (promise.exception && promise.scheduler) {
+        promise.scheduler->reportFailure(promise.exception);
+    }
+}
+
+// Coroutine-facing view of a ConsumerBarrier: co_await barrier.next(seq)
+// suspends without blocking a thread and yields the highest available sequence.
+template <typename T, typename EntryFactory = DefaultEntryFactory<T>>
+class AsyncConsumerBarrier {
+public:
+    AsyncConsumerBarrier(ConsumerBarrier<T, EntryFactory>* barrier, CoroutineScheduler* scheduler)
+        : barrier_(barrier), scheduler_(scheduler) {}
+
+    auto next(int64_t sequence) {
+        struct Awaiter : SequenceWaiter {
+            ConsumerBarrier<T, EntryFactory>* barrier;
+            CoroutineScheduler* scheduler;
+
+            int64_t getAvailableSequence() override { return barrier->getAvailableSequence(); }
+
+            bool await_ready() {
+                available = getAvailableSequence();
+                return available >= sequence;
+            }
+            void await_suspend(std::coroutine_handle<> caller) {
+                handle = caller;
+                scheduler->park(this);
+            }
+            int64_t await_resume() const noexcept { return available; }
+        };
+
+        Awaiter awaiter;
+        awaiter.source = barrier_;
+        awaiter.sequence = sequence;
+        awaiter.barrier = barrier_;
+        awaiter.scheduler = scheduler_;
+        return awaiter;
+    }
+
+    T& getEntry(int64_t sequence) { return barrier_->getEntry(sequence); }
+
+    const T& getEntry(int64_t sequence) const { return barrier_->getEntry(sequence); }
+
+private:
+    ConsumerBarrier<T, EntryFactory>* barrier_;
+    CoroutineScheduler* scheduler_;
+};
+
+} // namespace disruptor
@@ -8,6 +8,7 @@
 #include "disruptor/claim_strategy.h"
 #include "disruptor/consumer.h"
 #include "disruptor/consumer_barrier.h"
+#include "disruptor/event_poller.h"
 #include "disruptor/producer_barrier.h"
 #include "disruptor/ring_buffer.h"
 #include "disruptor/wait_strategy.h"
@@ -69,6 +70,39 @@ public:
         return consumer_ptr;
     }
 
+    EventPoller<T, EntryFactory>* createEventPoller(std::vector<Sequence*> dependencies = {}) {
+        auto consumer_barrier = std::make_unique<ConsumerBarrier<T, EntryFactory>>(
+            ring_buffer_.get(),
+            wait_strategy_.get(),
+            std::move(dependencies));
+
+        auto poller = std::make_unique<EventPoller<T, EntryFactory>>(consumer_barrier.get());
+        gating_sequences_.push_back(poller->getSequence());
+
+        EventPoller<T, EntryFactory>* poller_ptr = poller.get();
+        pollers_.push_back(std::move(poller));
+        consumer_barriers_.push_back(std::move(consumer_barrier));
+        return poller_ptr;
+    }
+
+    // Returns a barrier for callers that track their own consumer sequence; that
+    // sequence must be registered with addGatingSequence().
+    ConsumerBarrier<T, EntryFactory>* createConsumerBarrier(std::vector<Sequence*> dependencies = {}) {
+        consumer_barriers_.push_back(std::make_unique<ConsumerBarrier<T, EntryFactory>>(
+            ring_buffer_.get(),
+            wait_strategy_.get(),
+            std::move(dependencies)));
+        return consumer_barriers_.back().get();
+    }
+
+    void addGatingSequence(Sequence* sequence) {
+        if (producer_barrier_) {
+            throw std::logic_error(
+                "Gating sequences must be added before the producer barrier is created.");
+        }
+        gating_sequences_.push_back(sequence);
+    }
+
     void start() {
         for (auto& consumer : consumers_) {
             consumer->start();
@@ -88,8 +122,9 @@ private:
     std::unique_ptr<ClaimStrategy> claim_strategy_;
     std::unique_ptr<WaitStrategy> wait_strategy_;
     std::unique_ptr<ProducerBarrier<T, EntryFactory>> producer_barrier_;
-    std::vector<std::unique_ptr<Consumer<T, EntryFactory>>> consumers_;
     std::vector<std::unique_ptr<ConsumerBarrier<T, EntryFactory>>> consumer_barriers_;
+    std::vector<std::unique_ptr<Consumer<T, EntryFactory>>> consumers_;
+    std::vector<std::unique_ptr<EventPoller<T, EntryFactory>>> pollers_;
     std::vector<Sequence*> gating_sequences_;
 };
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "disruptor/batch_handler.h"
+#include "disruptor/consumer_barrier.h"
+#include "disruptor/sequence.h"
+
+namespace disruptor {
+
+// Pull-based alternative to Consumer: the caller's thread drains whatever is
+// already published instead of a dedicated thread waiting on the barrier, so a
+// single event loop can service many ring buffers.
+template <typename T, typename EntryFactory = DefaultEntryFactory<T>>
+class EventPoller {
+public:
+    explicit EventPoller(ConsumerBarrier<T, EntryFactory>* barrier)
+        : barrier_(barrier) {}
+
+    // Handles up to max_events available entries without waiting and returns
+    // whether any were consumed. If the handler throws, the exception
+    // propagates after the entries it already handled are marked consumed.
+    bool poll(BatchHandler<T>* handler, int64_t max_events = std::numeric_limits<int64_t>::max()) {
+        int64_t next_sequence = sequence_.get() + 1;
+        int64_t available = barrier_->getAvailableSequence();
+
+        if (available < next_sequence || max_events <= 0) {
+            return false;
+        }
+
+        if (available - next_sequence >= max_events) {
+            available = next_sequence + max_events - 1;
+        }
+
+        handler->setSequenceCallback(&sequence_);
+
+        try {
+            while (next_sequence <= available) {
+                T& entry = barrier_->getEntry(next_sequence);
+                bool end_of_batch = (next_sequence == available);
+
+                handler->onAvailable(entry, next_sequence, end_of_batch);
+                next_sequence++;
+            }
+        } catch (...) {
+            // Keep the entries handled before the throw; the failed one is
+            // delivered again on the next poll.
+            sequence_.set(next_sequence - 1);
+            throw;
+        }
+
+        sequence_.set(available);
+        return true;
+    }
+
+    Sequence* getSequence() { return &sequence_; }
+
+private:
+    ConsumerBarrier<T, EntryFactory>* barrier_;
+    Sequence sequence_{-1};
+};
+
+} // namespace disruptor
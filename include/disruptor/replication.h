@@ -0,0 +1,480 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "disruptor/batch_handler.h"
+#include "disruptor/producer_barrier.h"
+#include "disruptor/replication_transport.h"
+#include "disruptor/sequence.h"
+
+namespace disruptor {
+
+// Wire format shared by leader and follower. Entries are copied bytewise, so
+// both processes must agree on T's layout. HISTORY_LOST tells the follower
+// that [first, last] has already left the leader's history and can never be
+// retransmitted.
+enum class FrameType : uint32_t { DATA = 1, ACK = 2, NACK = 3, HISTORY_LOST = 4 };
+
+struct FrameHeader {
+    uint32_t magic;
+    FrameType type;
+    int64_t first_sequence;
+    int64_t last_sequence;
+};
+
+inline constexpr uint32_t kFrameMagic = 0x44525031;  // "DRP1"
+
+// Most frames resent for one NACK. The follower sizes its requests to match.
+inline constexpr size_t kRetransmitWindowFrames = 16;
+
+inline bool readFrameHeader(const unsigned char* data, size_t size, FrameHeader& header) {
+    if (size < sizeof(FrameHeader)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(FrameHeader));
+    return header.magic == kFrameMagic;
+}
+
+inline void sendControlFrame(ReplicationTransport* transport,
+                             FrameType type,
+                             int64_t first_sequence,
+                             int64_t last_sequence) {
+    FrameHeader header{kFrameMagic, type, first_sequence, last_sequence};
+    transport->send(&header, sizeof(header));
+}
+
+// Leader side: a consumer that streams published entries to the follower in
+// DATA frames of up to max_batch entries. Sent entries are kept in a history
+// ring of history_size entries to serve NACKs. Follower ACKs advance
+// getAcknowledgedSequence(); registering it with
+// Disruptor::addGatingSequence() holds the leader's producer back until the
+// follower has caught up, in which case history_size should be at least the
+// leader's ring size so every unacknowledged entry can be retransmitted.
+// NACKs for entries that have already left the history are answered with
+// HISTORY_LOST rather than a retransmission. Each NACK resends at most
+// kRetransmitWindowFrames frames, and a NACK starting inside the range just
+// resent is ignored for kRetransmitHoldoff while that resend is in flight.
+template <typename T>
+class ReplicatorHandler : public BatchHandler<T> {
+public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Replicated entries must be trivially copyable");
+
+    static constexpr std::chrono::microseconds kRetransmitHoldoff{500};
+
+    ReplicatorHandler(ReplicationTransport* transport, size_t history_size, size_t max_batch = 64)
+        : transport_(transport)
+        , max_batch_(max_batch)
+        , history_size_(history_size)
+        , frame_(sizeof(FrameHeader) + max_batch * sizeof(T))
+        , retransmit_frame_(frame_.size())
+        , history_(history_size * sizeof(T)) {
+        if (max_batch_ == 0 || frame_.size() > UdpTransport::kMaxDatagramSize) {
+            throw std::invalid_argument("max_batch must fit in a single datagram.");
+        }
+        if (history_size_ < max_batch_) {
+            throw std::invalid_argument("history_size must hold at least one frame.");
+        }
+    }
+
+    ~ReplicatorHandler() override {
+        stop();
+    }
+
+    // Starts the thread that services ACKs and NACKs from the follower.
+    void start() {
+        running_ = true;
+        control_thread_ = std::thread([this]() { runControl(); });
+    }
+
+    void stop() {
+        running_ = false;
+        if (control_thread_.joinable()) {
+            control_thread_.join();
+        }
+    }
+
+    Sequence* getAcknowledgedSequence() { return &acknowledged_; }
+
+    int64_t getRetransmittedCount() const { return retransmitted_.load(std::memory_order_relaxed); }
+
+    // Number of NACKs answered with HISTORY_LOST.
+    int64_t getHistoryLostCount() const { return history_lost_.load(std::memory_order_relaxed); }
+
+    void onAvailable(const T& entry, int64_t sequence, bool end_of_batch) override {
+        if (pending_count_ == 0) {
+            pending_first_ = sequence;
+        }
+        std::memcpy(frame_.data() + sizeof(FrameHeader) + pending_count_ * sizeof(T),
+                    &entry, sizeof(T));
+        pending_count_++;
+
+        if (pending_count_ == max_batch_ || end_of_batch) {
+            flush();
+        }
+    }
+
+private:
+    void flush() {
+        int64_t last = pending_first_ + static_cast<int64_t>(pending_count_) - 1;
+        FrameHeader header{kFrameMagic, FrameType::DATA, pending_first_, last};
+        std::memcpy(frame_.data(), &header, sizeof(header));
+
+        const unsigned char* payload = frame_.data() + sizeof(FrameHeader);
+        {
+            std::lock_guard<std::mutex> lock(history_mutex_);
+            for (size_t i = 0; i < pending_count_; ++i) {
+                std::memcpy(historySlot(pending_first_ + static_cast<int64_t>(i)),
+                            payload + i * sizeof(T), sizeof(T));
+            }
+            last_sent_ = last;
+        }
+
+        transport_->send(frame_.data(), sizeof(FrameHeader) + pending_count_ * sizeof(T));
+        pending_count_ = 0;
+    }
+
+    void runControl() {
+        unsigned char buffer[sizeof(FrameHeader)];
+        while (running_) {
+            size_t size = transport_->receive(buffer, sizeof(buffer), 1);
+            FrameHeader header;
+            if (!readFrameHeader(buffer, size, header)) {
+                continue;
+            }
+
+            if (header.type == FrameType::ACK) {
+                acknowledged_.setMonotonic(header.last_sequence);
+            } else if (header.type == FrameType::NACK) {
+                acknowledged_.setMonotonic(header.first_sequence - 1);
+
+                auto now = std::chrono::steady_clock::now();
+                if (header.first_sequence >= last_retransmit_first_ &&
+                    header.first_sequence <= last_retransmit_last_ &&
+                    now - last_retransmit_time_ < kRetransmitHoldoff) {
+                    continue;
+                }
+
+                int64_t window_last = header.first_sequence +
+                                      static_cast<int64_t>(max_batch_ * kRetransmitWindowFrames) - 1;
+                last_retransmit_first_ = header.first_sequence;
+                last_retransmit_last_ = std::min(header.last_sequence, window_last);
+                last_retransmit_time_ = now;
+                retransmit(last_retransmit_first_, last_retransmit_last_);
+            }
+        }
+    }
+
+    // Copies one frame at a time under the lock and sends it after unlocking,
+    // so flush() on the consumer thread is never held up by a long resend.
+    void retransmit(int64_t first, int64_t last) {
+        while (true) {
+            size_t count = 0;
+            int64_t lost_last = -1;
+            {
+                std::lock_guard<std::mutex> lock(history_mutex_);
+                last = std::min(last, last_sent_);
+                if (first > last) {
+                    return;
+                }
+
+                int64_t oldest = last_sent_ - static_cast<int64_t>(history_size_) + 1;
+                if (first < oldest) {
+                    lost_last = oldest - 1;
+                } else {
+                    int64_t frame_last =
+                        std::min(last, first + static_cast<int64_t>(max_batch_) - 1);
+                    FrameHeader header{kFrameMagic, FrameType::DATA, first, frame_last};
+                    std::memcpy(retransmit_frame_.data(), &header, sizeof(header));
+
+                    unsigned char* payload = retransmit_frame_.data() + sizeof(FrameHeader);
+                    count = static_cast<size_t>(frame_last - first + 1);
+                    for (size_t i = 0; i < count; ++i) {
+                        std::memcpy(payload + i * sizeof(T),
+                                    historySlot(first + static_cast<int64_t>(i)), sizeof(T));
+                    }
+                }
+            }
+
+            if (lost_last >= 0) {
+                sendControlFrame(transport_, FrameType::HISTORY_LOST, first, lost_last);
+                history_lost_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            transport_->send(retransmit_frame_.data(), sizeof(FrameHeader) + count * sizeof(T));
+            retransmitted_.fetch_add(static_cast<int64_t>(count), std::memory_order_relaxed);
+            first += static_cast<int64_t>(count);
+        }
+    }
+
+    unsigned char* historySlot(int64_t sequence) {
+        return history_.data() + (static_cast<size_t>(sequence) % history_size_) * sizeof(T);
+    }
+
+    ReplicationTransport* transport_;
+    const size_t max_batch_;
+    const size_t history_size_;
+    std::vector<unsigned char> frame_;
+    std::vector<unsigned char> retransmit_frame_;
+    size_t pending_count_ = 0;
+    int64_t pending_first_ = 0;
+
+    std::mutex history_mutex_;
+    std::vector<unsigned char> history_;
+    int64_t last_sent_ = -1;
+
+    int64_t last_retransmit_first_ = -1;
+    int64_t last_retransmit_last_ = -1;
+    std::chrono::steady_clock::time_point last_retransmit_time_;
+
+    Sequence acknowledged_{-1};
+    std::atomic<int64_t> retransmitted_{0};
+    std::atomic<int64_t> history_lost_{0};
+    std::atomic<bool> running_{false};
+    std::thread control_thread_;
+};
+
+// Follower side: republishes DATA frames into a local ring through its
+// ProducerBarrier so follower sequences match the leader's. Frames that skip
+// ahead of the next expected sequence are kept in a reorder stash of
+// reorder_capacity entries, and only the missing range in front of it is
+// NACKed, one retransmit window at a time. A request is left alone while its
+// range is being filled; one that makes no progress is repeated after
+// retransmit_timeout, backing off up to kMaxBackoff times that. If no DATA
+// arrives for a whole timeout the follower re-requests from its next expected
+// sequence so a lost tail frame is recovered too. If the leader answers with
+// HISTORY_LOST for the next expected sequence the follower cannot recover: it
+// stops requesting retransmits and isHistoryLost() reports the failure. The
+// local ring must be at least one frame large and start empty, like the
+// leader's; if its sequences stop matching, isMisaligned() reports it and the
+// follower stops republishing.
+template <typename T, typename EntryFactory = DefaultEntryFactory<T>>
+class ReplicationFollower {
+public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Replicated entries must be trivially copyable");
+
+    static constexpr int kMaxBackoff = 32;
+
+    ReplicationFollower(ProducerBarrier<T, EntryFactory>* producer_barrier,
+                        ReplicationTransport* transport,
+                        std::chrono::microseconds retransmit_timeout = std::chrono::milliseconds(1),
+                        size_t reorder_capacity = 1 << 16)
+        : producer_barrier_(producer_barrier)
+        , transport_(transport)
+        , retransmit_timeout_(retransmit_timeout)
+        , reorder_capacity_(reorder_capacity)
+        , buffer_(UdpTransport::kMaxDatagramSize)
+        , stash_(reorder_capacity * sizeof(T))
+        , stash_sequences_(reorder_capacity, -1) {
+        if (reorder_capacity_ == 0) {
+            throw std::invalid_argument("reorder_capacity must be positive.");
+        }
+    }
+
+    ~ReplicationFollower() {
+        stop();
+    }
+
+    void start() {
+        running_ = true;
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    Sequence* getReceivedSequence() { return &received_; }
+
+    int64_t getGapCount() const { return gaps_.load(std::memory_order_relaxed); }
+
+    bool isHistoryLost() const { return history_lost_.load(std::memory_order_acquire); }
+
+    bool isMisaligned() const { return misaligned_.load(std::memory_order_acquire); }
+
+private:
+    void run() {
+        expected_ = received_.get() + 1;
+        auto last_request = std::chrono::steady_clock::now();
+        auto last_data = last_request;
+        int64_t last_request_first = -1;
+        int64_t requested_last = -1;
+        // Repeats without progress back off exponentially, so a resend still
+        // queued behind a backlog is not requested again and again.
+        auto request_timeout = retransmit_timeout_;
+        auto request = [&](std::chrono::steady_clock::time_point now) {
+            if (expected_ == last_request_first) {
+                request_timeout = std::min(request_timeout * 2, retransmit_timeout_ * kMaxBackoff);
+            } else {
+                request_timeout = retransmit_timeout_;
+            }
+            requested_last = requestMissing();
+            last_request = now;
+            last_request_first = expected_;
+        };
+        int timeout_ms = static_cast<int>(
+            std::max<int64_t>(1, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     retransmit_timeout_).count()));
+
+        while (running_) {
+            size_t size = transport_->receive(buffer_.data(), buffer_.size(), timeout_ms);
+            auto now = std::chrono::steady_clock::now();
+
+            FrameHeader header;
+            bool valid = readFrameHeader(buffer_.data(), size, header);
+            if (valid && header.type == FrameType::HISTORY_LOST &&
+                header.first_sequence <= expected_ && expected_ <= header.last_sequence) {
+                history_lost_.store(true, std::memory_order_release);
+            }
+            if (history_lost_.load(std::memory_order_relaxed) ||
+                misaligned_.load(std::memory_order_relaxed)) {
+                continue;
+            }
+
+            if (!valid ||
+                header.type != FrameType::DATA ||
+                header.last_sequence < header.first_sequence ||
+                size != sizeof(FrameHeader) +
+                            static_cast<size_t>(header.last_sequence - header.first_sequence + 1) *
+                                sizeof(T)) {
+                if (now - last_data >= retransmit_timeout_ && now - last_request >= request_timeout) {
+                    request(now);
+                }
+                continue;
+            }
+            last_data = now;
+
+            if (header.last_sequence < expected_) {
+                sendControlFrame(transport_, FrameType::ACK, expected_ - 1, expected_ - 1);
+                continue;
+            }
+
+            const unsigned char* payload = buffer_.data() + sizeof(FrameHeader);
+            int frame_entries = static_cast<int>(header.last_sequence - header.first_sequence + 1);
+            max_frame_entries_ = std::max(max_frame_entries_, frame_entries);
+
+            if (header.first_sequence > expected_) {
+                gaps_.fetch_add(1, std::memory_order_relaxed);
+                stash(header.first_sequence, header.last_sequence, payload);
+            } else {
+                int64_t first = expected_;
+                payload += static_cast<size_t>(first - header.first_sequence) * sizeof(T);
+                republish(static_cast<int>(header.last_sequence - first + 1), [&](int i) {
+                    return payload + static_cast<size_t>(i) * sizeof(T);
+                });
+                drainStash();
+                sendControlFrame(transport_, FrameType::ACK, expected_ - 1, expected_ - 1);
+                if (expected_ <= requested_last) {
+                    last_request = now;
+                }
+            }
+
+            if (stash_high_ >= expected_ && !misaligned_.load(std::memory_order_relaxed) &&
+                (expected_ > requested_last || now - last_request >= request_timeout)) {
+                request(now);
+            }
+        }
+    }
+
+    // NACKs up to one retransmit window from expected_, stopping short of the
+    // first stashed entry, and returns the last sequence requested.
+    int64_t requestMissing() {
+        int64_t window = static_cast<int64_t>(kRetransmitWindowFrames) * std::max(1, max_frame_entries_);
+        int64_t last = expected_ + window - 1;
+        for (int64_t next = expected_ + 1; next <= std::min(last, stash_high_); ++next) {
+            if (stash_sequences_[stashIndex(next)] == next) {
+                last = next - 1;
+                break;
+            }
+        }
+        sendControlFrame(transport_, FrameType::NACK, expected_, last);
+        return last;
+    }
+
+    // Claims count entries at expected_ and fills entry i from source(i).
+    template <typename Source>
+    void republish(int count, Source&& source) {
+        int64_t hi = producer_barrier_->nextEntry(count);
+        int64_t lo = hi - count + 1;
+        if (lo != expected_) {
+            misaligned_.store(true, std::memory_order_release);
+            return;
+        }
+        for (int i = 0; i < count; ++i) {
+            T& entry = producer_barrier_->getEntry(lo + i);
+            std::memcpy(static_cast<void*>(&entry), source(i), sizeof(T));
+        }
+        producer_barrier_->commit(lo, hi);
+
+        expected_ = hi + 1;
+        received_.set(hi);
+    }
+
+    void stash(int64_t first, int64_t last, const unsigned char* payload) {
+        int64_t limit = std::min(last, expected_ + static_cast<int64_t>(reorder_capacity_) - 1);
+        for (int64_t sequence = first; sequence <= limit; ++sequence) {
+            std::memcpy(stashSlot(sequence), payload + static_cast<size_t>(sequence - first) * sizeof(T),
+                        sizeof(T));
+            stash_sequences_[stashIndex(sequence)] = sequence;
+        }
+        stash_high_ = std::max(stash_high_, limit);
+    }
+
+    // Republishes stashed entries that now follow on from expected_, in runs
+    // no longer than a frame so each claim fits the local ring.
+    void drainStash() {
+        while (!misaligned_.load(std::memory_order_relaxed)) {
+            int64_t first = expected_;
+            int count = 0;
+            while (count < max_frame_entries_ &&
+                   stash_sequences_[stashIndex(first + count)] == first + count) {
+                ++count;
+            }
+            if (count == 0) {
+                return;
+            }
+            republish(count, [&](int i) { return stashSlot(first + i); });
+        }
+    }
+
+    size_t stashIndex(int64_t sequence) const {
+        return static_cast<size_t>(sequence) % reorder_capacity_;
+    }
+
+    unsigned char* stashSlot(int64_t sequence) {
+        return stash_.data() + stashIndex(sequence) * sizeof(T);
+    }
+
+    ProducerBarrier<T, EntryFactory>* producer_barrier_;
+    ReplicationTransport* transport_;
+    const std::chrono::microseconds retransmit_timeout_;
+    const size_t reorder_capacity_;
+    std::vector<unsigned char> buffer_;
+    std::vector<unsigned char> stash_;
+    std::vector<int64_t> stash_sequences_;
+    int64_t stash_high_ = -1;
+    int64_t expected_ = 0;
+    int max_frame_entries_ = 0;
+    Sequence received_{-1};
+    std::atomic<int64_t> gaps_{0};
+    std::atomic<bool> history_lost_{false};
+    std::atomic<bool> misaligned_{false};
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+} // namespace disruptor
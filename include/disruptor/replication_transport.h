@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace disruptor {
+
+// Datagram channel between a leader and a follower. Delivery is best-effort;
+// the replication protocol detects loss and retransmits.
+class ReplicationTransport {
+public:
+    virtual ~ReplicationTransport() = default;
+
+    virtual void send(const void* data, size_t size) = 0;
+
+    // Returns the datagram size, or 0 if nothing arrived within timeout_ms.
+    virtual size_t receive(void* buffer, size_t capacity, int timeout_ms) = 0;
+};
+
+class UdpTransport : public ReplicationTransport {
+public:
+    static constexpr size_t kMaxDatagramSize = 65507;
+
+    UdpTransport(uint16_t local_port,
+                 const std::string& peer_host,
+                 uint16_t peer_port,
+                 int socket_buffer_bytes = 4 << 20) {
+        fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "socket");
+        }
+
+        ::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &socket_buffer_bytes, sizeof(socket_buffer_bytes));
+        ::setsockopt(fd_, SOL_SOCKET, SO_SNDBUF, &socket_buffer_bytes, sizeof(socket_buffer_bytes));
+
+        sockaddr_in local{};
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        local.sin_port = htons(local_port);
+        if (::bind(fd_, reinterpret_cast<sockaddr*>(&local), sizeof(local)) < 0) {
+            int error = errno;
+            ::close(fd_);
+            throw std::system_error(error, std::generic_category(), "bind");
+        }
+
+        sockaddr_in peer{};
+        peer.sin_family = AF_INET;
+        peer.sin_port = htons(peer_port);
+        if (::inet_pton(AF_INET, peer_host.c_str(), &peer.sin_addr) != 1 ||
+            ::connect(fd_, reinterpret_cast<sockaddr*>(&peer), sizeof(peer)) < 0) {
+            int error = errno;
+            ::close(fd_);
+            throw std::system_error(error, std::generic_category(), "connect " + peer_host);
+        }
+    }
+
+    ~UdpTransport() override {
+        ::close(fd_);
+    }
+
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Send failures (e.g. ECONNREFUSED before the peer binds) are treated as
+    // packet loss.
+    void send(const void* data, size_t size) override {
+        (void)::send(fd_, data, size, 0);
+    }
+
+    size_t receive(void* buffer, size_t capacity, int timeout_ms) override {
+        pollfd descriptor{fd_, POLLIN, 0};
+        if (::poll(&descriptor, 1, timeout_ms) <= 0) {
+            return 0;
+        }
+        ssize_t received = ::recv(fd_, buffer, capacity, MSG_DONTWAIT);
+        return received > 0 ? static_cast<size_t>(received) : 0;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+} // namespace disruptor
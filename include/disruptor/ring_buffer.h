@@ -18,6 +18,42 @@ struct DefaultEntryFactory {
     void reset(T&) const {}
 };
 
+// Factories may instead take the slot index as a trailing argument to
+// construct/destroy/reset, e.g. to keep per-slot state such as an arena. All
+// three must accept it; RingBuffer rejects a factory that mixes the two forms.
+template <typename EntryFactory, typename T, typename = void>
+struct HasSlotAwareConstruct : std::false_type {};
+
+template <typename EntryFactory, typename T>
+struct HasSlotAwareConstruct<
+    EntryFactory, T,
+    std::void_t<decltype(std::declval<EntryFactory&>().construct(std::declval<T*>(), size_t{}))>>
+    : std::true_type {};
+
+template <typename EntryFactory, typename T, typename = void>
+struct HasSlotAwareDestroy : std::false_type {};
+
+template <typename EntryFactory, typename T>
+struct HasSlotAwareDestroy<
+    EntryFactory, T,
+    std::void_t<decltype(std::declval<EntryFactory&>().destroy(std::declval<T*>(), size_t{}))>>
+    : std::true_type {};
+
+template <typename EntryFactory, typename T, typename = void>
+struct HasSlotAwareReset : std::false_type {};
+
+template <typename EntryFactory, typename T>
+struct HasSlotAwareReset<
+    EntryFactory, T,
+    std::void_t<decltype(std::declval<EntryFactory&>().reset(std::declval<T&>(), size_t{}))>>
+    : std::true_type {};
+
+template <typename EntryFactory, typename T>
+struct IsSlotAwareEntryFactory
+    : std::bool_constant<HasSlotAwareConstruct<EntryFactory, T>::value &&
+                         HasSlotAwareDestroy<EntryFactory, T>::value &&
+                         HasSlotAwareReset<EntryFactory, T>::value> {};
+
 template <typename T, typename EntryFactory = DefaultEntryFactory<T>>
 class RingBuffer {
 public:
@@ -28,14 +64,27 @@ public:
         , entry_factory_(std::move(entry_factory)) {
         static_assert(std::is_nothrow_destructible_v<T>,
                       "RingBuffer entries must be nothrow destructible");
+        static_assert(kSlotAware || !(HasSlotAwareConstruct<EntryFactory, T>::value ||
+                                      HasSlotAwareDestroy<EntryFactory, T>::value ||
+                                      HasSlotAwareReset<EntryFactory, T>::value),
+                      "A slot-aware EntryFactory must provide construct(T*, size_t), "
+                      "destroy(T*, size_t) and reset(T&, size_t)");
         for (size_t i = 0; i < buffer_size_; ++i) {
-            entry_factory_.construct(entryPointer(i));
+            if constexpr (kSlotAware) {
+                entry_factory_.construct(entryPointer(i), i);
+            } else {
+                entry_factory_.construct(entryPointer(i));
+            }
         }
     }
 
     ~RingBuffer() {
         for (size_t i = 0; i < buffer_size_; ++i) {
-            entry_factory_.destroy(entryPointer(i));
+            if constexpr (kSlotAware) {
+                entry_factory_.destroy(entryPointer(i), i);
+            } else {
+                entry_factory_.destroy(entryPointer(i));
+            }
         }
     }
 
@@ -53,7 +102,11 @@ public:
     }
 
     void prepareForWrite(int64_t sequence) {
-        entry_factory_.reset(get(sequence));
+        if constexpr (kSlotAware) {
+            entry_factory_.reset(get(sequence), static_cast<size_t>(sequence) & index_mask_);
+        } else {
+            entry_factory_.reset(get(sequence));
+        }
     }
 
     Sequence* getCursor() { return &cursor_; }
@@ -68,6 +121,8 @@ public:
     }
 
 private:
+    static constexpr bool kSlotAware = IsSlotAwareEntryFactory<EntryFactory, T>::value;
+
     using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
 
     T* entryPointer(size_t index) {
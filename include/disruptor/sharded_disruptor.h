@@ -0,0 +1,227 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "disruptor/batch_handler.h"
+#include "disruptor/consumer_barrier.h"
+#include "disruptor/disruptor.h"
+#include "disruptor/sequence.h"
+#include "disruptor/wait_strategy.h"
+
+namespace disruptor {
+
+// Routes events by key onto independent Disruptor shards so sequencing and
+// consumption scale across cores. Events sharing a key always land on the same
+// shard and are therefore handled in publish order.
+//
+// Each shard uses a single-threaded claim strategy: publish() may run on
+// several threads at once only if those threads route to disjoint shards.
+template <typename T, typename Key = int64_t, typename Hash = std::hash<Key>>
+class ShardedDisruptor {
+public:
+    using Shard = Disruptor<T>;
+    using WaitStrategyType = typename Shard::WaitStrategyType;
+
+    // Consumer threads are pinned round-robin over cpus in creation order.
+    ShardedDisruptor(size_t shard_count,
+                     size_t buffer_size,
+                     WaitStrategyType wait_type = WaitStrategyType::YIELDING,
+                     std::vector<int> cpus = {},
+                     Hash hash = Hash())
+        : hash_(std::move(hash)), cpus_(std::move(cpus)) {
+        if (shard_count == 0) {
+            throw std::invalid_argument("ShardedDisruptor requires at least one shard.");
+        }
+        if (wait_type == WaitStrategyType::BUSY_SPIN) {
+            merge_wait_strategy_ = std::make_unique<BusySpinWaitStrategy>();
+        } else {
+            merge_wait_strategy_ = std::make_unique<YieldingWaitStrategy>();
+        }
+        for (size_t i = 0; i < shard_count; ++i) {
+            auto state = std::make_unique<ShardState>();
+            state->disruptor = std::make_unique<Shard>(
+                buffer_size, Shard::ClaimStrategyType::SINGLE_THREADED, wait_type);
+            state->index_mask = state->disruptor->getRingBuffer()->getBufferSize() - 1;
+            shards_.push_back(std::move(state));
+        }
+    }
+
+    ~ShardedDisruptor() {
+        stop();
+    }
+
+    ShardedDisruptor(const ShardedDisruptor&) = delete;
+    ShardedDisruptor& operator=(const ShardedDisruptor&) = delete;
+
+    size_t getShardCount() const { return shards_.size(); }
+
+    size_t shardFor(const Key& key) const {
+        return static_cast<size_t>(mixBits(static_cast<uint64_t>(hash_(key))) % shards_.size());
+    }
+
+    Shard* getShard(size_t shard) { return shards_[shard]->disruptor.get(); }
+
+    // Adds one pipeline stage: handlers[i] consumes shard i after the
+    // previous stage on that shard.
+    void handleEventsWith(const std::vector<BatchHandler<T>*>& handlers) {
+        if (merge_handler_) {
+            throw std::logic_error("Stages must be added before the merge stage.");
+        }
+        if (handlers.size() != shards_.size()) {
+            throw std::invalid_argument("Expected one handler per shard.");
+        }
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            ShardState& state = *shards_[i];
+            auto* consumer = state.disruptor->createConsumer(handlers[i], state.last_stage);
+            if (!cpus_.empty()) {
+                consumer->setCpuAffinity(cpus_[next_cpu_++ % cpus_.size()]);
+            }
+            state.last_stage = {consumer->getSequence()};
+        }
+    }
+
+    // Optional final stage that re-sequences the output of every shard into
+    // global publish order. The handler receives the global sequence. The merge
+    // thread backs off through the configured wait strategy and is pinned to
+    // cpu unless it is -1.
+    void mergeWith(BatchHandler<T>* handler, int cpu = -1) {
+        if (merge_handler_) {
+            throw std::logic_error("A merge stage has already been added.");
+        }
+        merge_handler_ = handler;
+        merge_cpu_ = cpu;
+        for (auto& state : shards_) {
+            state->merge_barrier = state->disruptor->createConsumerBarrier(state->last_stage);
+            state->disruptor->addGatingSequence(&state->merge_sequence);
+            state->global_sequences.assign(state->index_mask + 1, -1);
+        }
+    }
+
+    template <typename Translator>
+    int64_t publish(const Key& key, Translator&& translate) {
+        return publishToShard(shardFor(key), std::forward<Translator>(translate));
+    }
+
+    // Returns the sequence within the shard's ring buffer.
+    template <typename Translator>
+    int64_t publishToShard(size_t shard, Translator&& translate) {
+        ShardState& state = *shards_[shard];
+        auto* producer = state.disruptor->getProducerBarrier();
+        int64_t sequence = producer->nextEntry();
+        translate(producer->getEntry(sequence));
+        if (merge_handler_) {
+            state.global_sequences[sequence & state.index_mask] =
+                next_global_sequence_.fetch_add(1, std::memory_order_relaxed);
+        }
+        producer->commit(sequence);
+        return sequence;
+    }
+
+    void start() {
+        for (auto& state : shards_) {
+            state->disruptor->getProducerBarrier();
+            state->disruptor->start();
+        }
+        if (merge_handler_) {
+            merging_ = true;
+            merge_thread_ = std::thread([this]() { runMerge(); });
+            pinThreadToCpu(merge_thread_, merge_cpu_);
+        }
+    }
+
+    void stop() {
+        merging_ = false;
+        if (merge_thread_.joinable()) {
+            merge_thread_.join();
+        }
+        for (auto& state : shards_) {
+            state->disruptor->stop();
+        }
+    }
+
+private:
+    struct ShardState {
+        std::unique_ptr<Shard> disruptor;
+        size_t index_mask = 0;
+        std::vector<Sequence*> last_stage;
+        ConsumerBarrier<T>* merge_barrier = nullptr;
+        Sequence merge_sequence{-1};
+        std::vector<int64_t> global_sequences;
+    };
+
+    // std::hash maps integers to themselves, so any pattern in the keys (e.g.
+    // all even) would pick the shard. The splitmix64 finalizer spreads them.
+    static uint64_t mixBits(uint64_t h) {
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebULL;
+        h ^= h >> 31;
+        return h;
+    }
+
+    void runMerge() {
+        int64_t expected = 0;
+        std::vector<int64_t> next_sequences(shards_.size());
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            next_sequences[i] = shards_[i]->merge_sequence.get() + 1;
+            expected += next_sequences[i];
+        }
+
+        int spin_tries = 0;
+        while (merging_) {
+            bool progressed = false;
+            for (size_t i = 0; i < shards_.size(); ++i) {
+                ShardState& state = *shards_[i];
+                int64_t& next_sequence = next_sequences[i];
+                int64_t available = state.merge_barrier->getAvailableSequence();
+
+                int64_t start = next_sequence;
+                while (next_sequence <= available &&
+                       state.global_sequences[next_sequence & state.index_mask] == expected) {
+                    bool end_of_batch =
+                        next_sequence == available ||
+                        state.global_sequences[(next_sequence + 1) & state.index_mask] !=
+                            expected + 1;
+                    merge_handler_->onAvailable(state.disruptor->getRingBuffer()->get(next_sequence),
+                                                expected, end_of_batch);
+                    next_sequence++;
+                    expected++;
+                }
+
+                if (next_sequence != start) {
+                    state.merge_sequence.set(next_sequence - 1);
+                    progressed = true;
+                }
+            }
+
+            if (progressed) {
+                spin_tries = 0;
+            } else {
+                merge_wait_strategy_->idle(spin_tries);
+            }
+        }
+
+        merge_handler_->onCompletion();
+    }
+
+    Hash hash_;
+    std::vector<int> cpus_;
+    size_t next_cpu_ = 0;
+    std::vector<std::unique_ptr<ShardState>> shards_;
+    BatchHandler<T>* merge_handler_ = nullptr;
+    std::unique_ptr<WaitStrategy> merge_wait_strategy_;
+    int merge_cpu_ = -1;
+    std::atomic<int64_t> next_global_sequence_{0};
+    std::atomic<bool> merging_{false};
+    std::thread merge_thread_;
+};
+
+} // namespace disruptor
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <exception>
 #include <thread>
 #include <vector>
 
@@ -9,13 +10,23 @@
 
 namespace disruptor {
 
+class AlertException : public std::exception {
+public:
+    const char* what() const noexcept override { return "consumer barrier alerted"; }
+};
+
 class WaitStrategy {
 public:
     virtual ~WaitStrategy() = default;
 
     virtual int64_t waitFor(int64_t sequence,
                             Sequence* cursor,
-                            std::vector<Sequence*>& dependents) = 0;
+                            std::vector<Sequence*>& dependents,
+                            const std::atomic<bool>& alerted) = 0;
+
+    // Backs off once while a caller polling several sequences finds nothing
+    // ready; spin_tries carries state between calls.
+    virtual void idle(int& /*spin_tries*/) { std::this_thread::yield(); }
 
     virtual void signalAllWhenBlocking() {}
 };
@@ -24,30 +35,42 @@ class BusySpinWaitStrategy : public WaitStrategy {
 public:
     int64_t waitFor(int64_t sequence,
                     Sequence* cursor,
-                    std::vector<Sequence*>& dependents) override {
+                    std::vector<Sequence*>& dependents,
+                    const std::atomic<bool>& alerted) override {
         while (true) {
             int64_t available = getMinimumSequence(cursor, dependents);
             if (available >= sequence) {
                 return available;
             }
+            if (alerted.load(std::memory_order_acquire)) {
+                throw AlertException();
+            }
             // This fence does not establish synchronization; it simply reduces
             // aggressive loop optimizations on some architectures.
             std::atomic_thread_fence(std::memory_order_acquire);
         }
     }
+
+    void idle(int& /*spin_tries*/) override {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
 };
 
 class YieldingWaitStrategy : public WaitStrategy {
 public:
     int64_t waitFor(int64_t sequence,
                     Sequence* cursor,
-                    std::vector<Sequence*>& dependents) override {
+                    std::vector<Sequence*>& dependents,
+                    const std::atomic<bool>& alerted) override {
         int spin_tries = 0;
         while (true) {
             int64_t available = getMinimumSequence(cursor, dependents);
             if (available >= sequence) {
                 return available;
             }
+            if (alerted.load(std::memory_order_acquire)) {
+                throw AlertException();
+            }
 
             if (++spin_tries > 100) {
                 std::this_thread::yield();
@@ -55,6 +78,13 @@ public:
             }
         }
     }
+
+    void idle(int& spin_tries) override {
+        if (++spin_tries > 100) {
+            std::this_thread::yield();
+            spin_tries = 0;
+        }
+    }
 };
 
 } // namespace disruptor